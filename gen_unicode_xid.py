@@ -0,0 +1,102 @@
+"""
+Generator for unicode_xid_ranges.h
+Purpose: This script writes the XID_Start and XID_Continue code point ranges that lexer_float.c
+uses to classify non-ASCII characters in identifiers. Only code points from U+0080 upwards are
+written, because ASCII is classified by the lexer's own table.
+Connector punctuation (general category Pc, e.g. U+203F and U+FF3F) is left out of XID_Continue,
+so identifiers reject every connector, just as they reject the ASCII '_'.
+
+How to Run:
+1. Download DerivedCoreProperties.txt for the wanted Unicode version from
+   https://www.unicode.org/Public/UCD/latest/ucd/DerivedCoreProperties.txt
+2. Run the script from the directory containing lexer_float.c:
+     python3 gen_unicode_xid.py DerivedCoreProperties.txt > unicode_xid_ranges.h
+3. Without an argument, the ranges come from Python's unicodedata module instead
+   (str.isidentifier() is defined by the same XID_Start/XID_Continue properties):
+     python3 gen_unicode_xid.py > unicode_xid_ranges.h
+"""
+
+import sys
+import unicodedata
+
+FIRST_CODE_POINT = 0x80
+LAST_CODE_POINT = 0x10FFFF
+
+
+def ranges_from_file(path, prop):
+    """Read the ranges of one property from DerivedCoreProperties.txt, skipping Pc entries."""
+    ranges = []
+    with open(path, encoding="utf-8") as f:
+        for line in f:
+            data, _, comment = line.partition("#")
+            fields = data.split(";")
+            if len(fields) != 2 or fields[1].strip() != prop:
+                continue
+            if comment.split()[:1] == ["Pc"]:  # The comment starts with the general category
+                continue
+            bounds = fields[0].strip().split("..")
+            first = int(bounds[0], 16)
+            last = int(bounds[-1], 16)
+            if last >= FIRST_CODE_POINT:
+                ranges.append((max(first, FIRST_CODE_POINT), last))
+    return merge(sorted(ranges))
+
+
+def ranges_from_python(is_member):
+    """Collect the ranges of code points accepted by is_member."""
+    ranges = []
+    for cp in range(FIRST_CODE_POINT, LAST_CODE_POINT + 1):
+        if is_member(chr(cp)):
+            if ranges and ranges[-1][1] == cp - 1:
+                ranges[-1] = (ranges[-1][0], cp)
+            else:
+                ranges.append((cp, cp))
+    return ranges
+
+
+def merge(ranges):
+    """Join ranges that touch or overlap."""
+    merged = []
+    for first, last in ranges:
+        if merged and first <= merged[-1][1] + 1:
+            merged[-1] = (merged[-1][0], max(merged[-1][1], last))
+        else:
+            merged.append((first, last))
+    return merged
+
+
+def emit(name, ranges):
+    print("const unsigned int %s[][2] = {" % name)
+    for i in range(0, len(ranges), 4):
+        row = ", ".join("{0x%05X, 0x%05X}" % r for r in ranges[i:i + 4])
+        print("    %s%s" % (row, "," if i + 4 < len(ranges) else ""))
+    print("};")
+
+
+def main():
+    if len(sys.argv) > 1:
+        source = sys.argv[1]
+        start = ranges_from_file(source, "XID_Start")
+        cont = ranges_from_file(source, "XID_Continue")
+    else:
+        source = "Python unicodedata, Unicode %s" % unicodedata.unidata_version
+        start = ranges_from_python(lambda c: c.isidentifier())
+        cont = ranges_from_python(
+            lambda c: ("a" + c).isidentifier() and unicodedata.category(c) != "Pc")
+
+    print("/*")
+    print(" * Unicode identifier ranges for lexer_float.c - generated by gen_unicode_xid.py, do not edit.")
+    print(" * Source: %s" % source)
+    print(" * Inclusive, sorted code point ranges from U+0080 upwards (ASCII uses the lexer's own table).")
+    print(" * XID_Start contains letters (L*, Nl); XID_Continue adds marks (Mn, Mc) and digits (Nd).")
+    print(" * Connector punctuation (Pc) is left out of XID_Continue, matching the lexer's rejection of")
+    print(" * '_' in identifiers. Every XID_Start code point is also in XID_Continue.")
+    print(" */")
+    print()
+    emit("xidStartRanges", start)
+    print()
+    emit("xidContinueRanges", cont)
+
+
+if __name__ == "__main__":
+    main()
@@ -3,22 +3,32 @@
  * Lexical Analyser with Floating Point Support - Extended Tutorial 2
  * Purpose: This lexer version extends the basic lexer by recognising floating-point numbers
  * (e.g., 3.14, 0.001) in addition to unsigned integers, keywords, operators, and identifiers.
+ * It also recognises exponent forms (e.g., 1e-9, 6.02E23), hexadecimal integers (e.g., 0x1F)
+ * and digit separators (e.g., 1_000_000) inside any numeric literal.
  * 
  * How to Compile and Run:
- * 1. Save this file as "lexer_float.c".
- * 2. Open a terminal and navigate to the directory where the file is saved.
+ * 1. Save this file as "lexer_float.c", with "unicode_xid_ranges.h" in the same directory
+ *    (the lexer includes it for the Unicode identifier ranges).
+ * 2. Open a terminal and navigate to the directory where the files are saved.
  * 3. Compile the code using the command:
  *      gcc lexer_float.c -o lexer_float
  * 4. Run the lexer with the command:
  *      ./lexer_float
  * 5. Enter a string when prompted to see recognised tokens, including floating-point numbers.
  *
- * This version introduces a TOKEN_FLOAT type, allowing the lexer to classify floating-point literals.
+ * This version introduces a TOKEN_FLOAT type, allowing the lexer to classify floating-point literals,
+ * plus TOKEN_EXPONENT and TOKEN_HEX_INTEGER for the exponent and hexadecimal forms.
+ * A '_' separator must sit between two digits, so "1__0", "1_" and "_1" are not numbers.
+ * Input is read as UTF-8. After "id", an identifier may contain any Unicode XID_Continue
+ * character: letters, combining marks and non-ASCII digits, e.g. idπ, idкод, idコーヒー, idनमस्ते.
+ * The identifier itself starts with the letter 'i', so no separate start rule is needed. Malformed
+ * UTF-8 makes a token Unknown. Connector punctuation (Pc) is rejected like the ASCII '_', so idx_y and
+ * idx‿y are both Unknown. The ranges live in unicode_xid_ranges.h, generated by gen_unicode_xid.py.
  */
 
 #include <stdio.h>
-#include <ctype.h>
 #include <string.h>
+#include "unicode_xid_ranges.h" // XID_Start / XID_Continue ranges, generated by gen_unicode_xid.py
 
 // Token types that the lexer will recognise
 typedef enum
@@ -29,102 +39,240 @@ typedef enum
     TOKEN_FLOAT,            // Floating-point number (e.g., 3.14)
     TOKEN_OPERATOR,         // Arithmetic operators (+, -, *, /)
     TOKEN_IDENTIFIER,       // An identifier starting with "id"
-    TOKEN_UNKNOWN           // An unknown token that doesn't match any rule
+    TOKEN_UNKNOWN,          // An unknown token that doesn't match any rule
+    // Added after TOKEN_UNKNOWN so the values of the original token types stay unchanged
+    TOKEN_EXPONENT,         // Number with an exponent (e.g., 1e-9, 6.02E23)
+    TOKEN_HEX_INTEGER       // Hexadecimal integer (e.g., 0x1F)
 } TokenType;
 
 // DFA states to process each character of the input
 enum
 {
-    START,             // Starting state
-    IN_KEYWORD,        // State for recognising the "in" keyword
-    OUT_KEYWORD,       // State for recognising the "out" keyword
-    UNSIGNED_INTEGER,  // State for recognising integers
-    DOT_SEEN,          // State after seeing a '.' after digits (waiting for digits)
-    FLOAT,             // State for recognising floating-point numbers
-    IDENTIFIER_PREFIX, // State when "id" is recognised as an identifier prefix
-    IDENTIFIER,        // State for continuing identifier recognition
-    OPERATOR,          // State for recognising operators
-    ERROR              // Error state for invalid inputs
+    START,               // Starting state
+    IN_KEYWORD,          // State for recognising the "in" keyword
+    OUT_KEYWORD,         // State for recognising the "out" keyword
+    UNSIGNED_INTEGER,    // State for recognising integers
+    LEADING_ZERO,        // State after a leading '0' (may start a hex prefix)
+    INTEGER_UNDERSCORE,  // State after a '_' inside an integer (waiting for a digit)
+    DOT_SEEN,            // State after seeing a '.' after digits (waiting for digits)
+    FLOAT,               // State for recognising floating-point numbers
+    FLOAT_UNDERSCORE,    // State after a '_' in the fraction (waiting for a digit)
+    EXPONENT_MARK,       // State after 'e' or 'E' (waiting for a sign or digit)
+    EXPONENT_SIGN,       // State after the exponent sign (waiting for a digit)
+    EXPONENT,            // State for recognising exponent digits
+    EXPONENT_UNDERSCORE, // State after a '_' in the exponent (waiting for a digit)
+    HEX_PREFIX,          // State after "0x" (waiting for a hex digit)
+    HEX_INTEGER,         // State for recognising hex digits
+    HEX_UNDERSCORE,      // State after a '_' in a hex number (waiting for a hex digit)
+    IDENTIFIER_PREFIX,   // State when "id" is recognised as an identifier prefix
+    IDENTIFIER,          // State for continuing identifier recognition
+    OPERATOR,            // State for recognising operators
+    ERROR                // Error state for invalid inputs
 };
 
 // Character classes based on character type (letters, digits, operators, dot, unknown)
+// Letters that carry meaning inside numbers get their own classes so the DFA can tell them apart
 enum
 {
-    CHAR_LETTER,   // Alphabetic characters
-    CHAR_DIGIT,    // Digits (0-9)
-    CHAR_OPERATOR, // Arithmetic operators (+, -, *, /)
-    CHAR_DOT,      // Decimal point '.'
-    CHAR_UNKNOWN   // Any other character
+    CHAR_LETTER,     // Alphabetic characters not listed below
+    CHAR_HEX_LETTER, // Hex digit letters other than 'e' (a-d, f, A-D, F)
+    CHAR_EXPONENT,   // Exponent marker 'e' or 'E' (also a hex digit)
+    CHAR_HEX_MARK,   // Hex prefix marker 'x' or 'X'
+    CHAR_ZERO,       // The digit '0'
+    CHAR_DIGIT,      // Digits (1-9)
+    CHAR_UNDERSCORE, // Digit separator '_'
+    CHAR_SIGN,       // Operators that can also sign an exponent (+, -)
+    CHAR_OPERATOR,   // Remaining arithmetic operators (*, /)
+    CHAR_DOT,        // Decimal point '.'
+    CHAR_CONTINUE,   // Non-ASCII XID_Continue character that is not XID_Start (marks, digits)
+    CHAR_UNKNOWN     // Any other character
 };
 
 // Transition table (rows: states, columns: character classes)
 // Defines how the DFA transitions between states for each input character type
-// Columns: CHAR_LETTER, CHAR_DIGIT, CHAR_OPERATOR, CHAR_DOT, CHAR_UNKNOWN
-int transitionTable[10][5] = {
-    // CHAR_LETTER,  CHAR_DIGIT,  CHAR_OPERATOR, CHAR_DOT,   CHAR_UNKNOWN
-    {IDENTIFIER_PREFIX, UNSIGNED_INTEGER, OPERATOR, ERROR, ERROR}, // START
-    {ERROR, ERROR, ERROR, ERROR, ERROR},                           // IN_KEYWORD
-    {ERROR, ERROR, ERROR, ERROR, ERROR},                           // OUT_KEYWORD
-    {ERROR, UNSIGNED_INTEGER, ERROR, DOT_SEEN, ERROR},             // UNSIGNED_INTEGER
-    {ERROR, FLOAT, ERROR, ERROR, ERROR},                           // DOT_SEEN (must see digit after '.')
-    {ERROR, FLOAT, ERROR, ERROR, ERROR},                           // FLOAT (digits after '.')
-    {IDENTIFIER, ERROR, ERROR, ERROR, ERROR},                      // IDENTIFIER_PREFIX
-    {IDENTIFIER, IDENTIFIER, ERROR, ERROR, ERROR},                 // IDENTIFIER
-    {ERROR, ERROR, ERROR, ERROR, ERROR},                           // OPERATOR
-    {ERROR, ERROR, ERROR, ERROR, ERROR}                            // ERROR
+// Columns: CHAR_LETTER, CHAR_HEX_LETTER, CHAR_EXPONENT, CHAR_HEX_MARK, CHAR_ZERO, CHAR_DIGIT,
+//          CHAR_UNDERSCORE, CHAR_SIGN, CHAR_OPERATOR, CHAR_DOT, CHAR_CONTINUE, CHAR_UNKNOWN
+int transitionTable[20][12] = {
+    // LETTER, HEX_LETTER, EXPONENT, HEX_MARK, ZERO, DIGIT, UNDERSCORE, SIGN, OPERATOR, DOT, CONTINUE, UNKNOWN
+    {IDENTIFIER_PREFIX, IDENTIFIER_PREFIX, IDENTIFIER_PREFIX, IDENTIFIER_PREFIX, LEADING_ZERO, UNSIGNED_INTEGER, ERROR, OPERATOR, OPERATOR, ERROR, ERROR, ERROR}, // START
+    {ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                                    // IN_KEYWORD
+    {ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                                    // OUT_KEYWORD
+    {ERROR, ERROR, EXPONENT_MARK, ERROR, UNSIGNED_INTEGER, UNSIGNED_INTEGER, INTEGER_UNDERSCORE, ERROR, ERROR, DOT_SEEN, ERROR, ERROR},      // UNSIGNED_INTEGER
+    {ERROR, ERROR, EXPONENT_MARK, HEX_PREFIX, UNSIGNED_INTEGER, UNSIGNED_INTEGER, INTEGER_UNDERSCORE, ERROR, ERROR, DOT_SEEN, ERROR, ERROR}, // LEADING_ZERO
+    {ERROR, ERROR, ERROR, ERROR, UNSIGNED_INTEGER, UNSIGNED_INTEGER, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                              // INTEGER_UNDERSCORE
+    {ERROR, ERROR, ERROR, ERROR, FLOAT, FLOAT, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                                    // DOT_SEEN (must see digit after '.')
+    {ERROR, ERROR, EXPONENT_MARK, ERROR, FLOAT, FLOAT, FLOAT_UNDERSCORE, ERROR, ERROR, ERROR, ERROR, ERROR},                                 // FLOAT (digits after '.')
+    {ERROR, ERROR, ERROR, ERROR, FLOAT, FLOAT, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                                    // FLOAT_UNDERSCORE
+    {ERROR, ERROR, ERROR, ERROR, EXPONENT, EXPONENT, ERROR, EXPONENT_SIGN, ERROR, ERROR, ERROR, ERROR},                                      // EXPONENT_MARK
+    {ERROR, ERROR, ERROR, ERROR, EXPONENT, EXPONENT, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                              // EXPONENT_SIGN
+    {ERROR, ERROR, ERROR, ERROR, EXPONENT, EXPONENT, EXPONENT_UNDERSCORE, ERROR, ERROR, ERROR, ERROR, ERROR},                                // EXPONENT
+    {ERROR, ERROR, ERROR, ERROR, EXPONENT, EXPONENT, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                              // EXPONENT_UNDERSCORE
+    {ERROR, HEX_INTEGER, HEX_INTEGER, ERROR, HEX_INTEGER, HEX_INTEGER, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                            // HEX_PREFIX (must see hex digit after "0x")
+    {ERROR, HEX_INTEGER, HEX_INTEGER, ERROR, HEX_INTEGER, HEX_INTEGER, HEX_UNDERSCORE, ERROR, ERROR, ERROR, ERROR, ERROR},                   // HEX_INTEGER
+    {ERROR, HEX_INTEGER, HEX_INTEGER, ERROR, HEX_INTEGER, HEX_INTEGER, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                            // HEX_UNDERSCORE
+    {IDENTIFIER, IDENTIFIER, IDENTIFIER, IDENTIFIER, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                // IDENTIFIER_PREFIX
+    {IDENTIFIER, IDENTIFIER, IDENTIFIER, IDENTIFIER, IDENTIFIER, IDENTIFIER, ERROR, ERROR, ERROR, ERROR, IDENTIFIER, ERROR},                 // IDENTIFIER
+    {ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR},                                                    // OPERATOR
+    {ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR, ERROR}                                                     // ERROR
 };
 
-// Function to classify characters into CHAR_LETTER, CHAR_DIGIT, CHAR_OPERATOR, CHAR_DOT, or CHAR_UNKNOWN
-int getCharClass(char c)
+// Character class of every ASCII byte (0x00-0x7F), so classifying ASCII is a single lookup
+// Short aliases keep the 16-per-row layout readable; they are undefined after the table
+#define U_ CHAR_UNKNOWN
+#define L_ CHAR_LETTER
+#define H_ CHAR_HEX_LETTER
+#define E_ CHAR_EXPONENT
+#define X_ CHAR_HEX_MARK
+#define Z_ CHAR_ZERO
+#define D_ CHAR_DIGIT
+#define US CHAR_UNDERSCORE
+#define S_ CHAR_SIGN
+#define O_ CHAR_OPERATOR
+#define P_ CHAR_DOT
+const unsigned char asciiCharClass[128] = {
+    U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, // 0x00-0x0F control characters
+    U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, // 0x10-0x1F control characters
+    U_, U_, U_, U_, U_, U_, U_, U_, U_, U_, O_, S_, U_, S_, P_, O_, // 0x20-0x2F  !"#$%&'()*+,-./
+    Z_, D_, D_, D_, D_, D_, D_, D_, D_, D_, U_, U_, U_, U_, U_, U_, // 0x30-0x3F 0123456789:;<=>?
+    U_, H_, H_, H_, H_, E_, H_, L_, L_, L_, L_, L_, L_, L_, L_, L_, // 0x40-0x4F @ABCDEFGHIJKLMNO
+    L_, L_, L_, L_, L_, L_, L_, L_, X_, L_, L_, U_, U_, U_, U_, US, // 0x50-0x5F PQRSTUVWXYZ[\]^_
+    U_, H_, H_, H_, H_, E_, H_, L_, L_, L_, L_, L_, L_, L_, L_, L_, // 0x60-0x6F `abcdefghijklmno
+    L_, L_, L_, L_, L_, L_, L_, L_, X_, L_, L_, U_, U_, U_, U_, U_  // 0x70-0x7F pqrstuvwxyz{|}~ DEL
+};
+#undef U_
+#undef L_
+#undef H_
+#undef E_
+#undef X_
+#undef Z_
+#undef D_
+#undef US
+#undef S_
+#undef O_
+#undef P_
+
+// Function to check whether a code point lies in a sorted table of inclusive ranges (binary search)
+int isInRanges(unsigned int codePoint, const unsigned int ranges[][2], int count)
+{
+    int low = 0, high = count - 1;
+    while (low <= high)
+    {
+        int mid = (low + high) / 2;
+        if (codePoint < ranges[mid][0])
+            high = mid - 1;
+        else if (codePoint > ranges[mid][1])
+            low = mid + 1;
+        else
+            return 1;
+    }
+    return 0;
+}
+
+// Function to validate one multi-byte UTF-8 sequence starting at s (s[0] >= 0x80)
+// Returns the sequence length (2-4) and stores the decoded code point, or returns 0 if the
+// sequence is malformed, overlong, a surrogate or above U+10FFFF (RFC 3629)
+int decodeUtf8(const unsigned char *s, unsigned int *codePoint)
+{
+    unsigned char lead = s[0];
+    unsigned char low = 0x80, high = 0xBF; // Allowed range for the second byte
+    int length;
+
+    if (lead >= 0xC2 && lead <= 0xDF)
+        length = 2;
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        length = 3;
+        if (lead == 0xE0)
+            low = 0xA0; // Reject overlong 3-byte forms
+        else if (lead == 0xED)
+            high = 0x9F; // Reject UTF-16 surrogates
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        length = 4;
+        if (lead == 0xF0)
+            low = 0x90; // Reject overlong 4-byte forms
+        else if (lead == 0xF4)
+            high = 0x8F; // Reject code points above U+10FFFF
+    }
+    else
+        return 0; // Stray continuation byte, overlong 2-byte lead, or invalid byte
+
+    if (s[1] < low || s[1] > high)
+        return 0;
+    *codePoint = lead & (0xFF >> (length + 1));
+    *codePoint = (*codePoint << 6) | (s[1] & 0x3F);
+
+    // Remaining bytes must be continuation bytes; the string's '\0' fails this check
+    for (int k = 2; k < length; k++)
+    {
+        if ((s[k] & 0xC0) != 0x80)
+            return 0;
+        *codePoint = (*codePoint << 6) | (s[k] & 0x3F);
+    }
+    return length;
+}
+
+// Function to classify the character starting at s into the character classes above
+// ASCII bytes take the table lookup; multi-byte UTF-8 sequences are validated, then an XID_Start
+// code point is classified as CHAR_LETTER and any other XID_Continue code point as CHAR_CONTINUE.
+// The number of bytes consumed is stored in *length
+int getCharClass(const unsigned char *s, int *length)
 {
-    if (isalpha(c)) // Check if the character is an alphabet
+    if (s[0] < 0x80) // ASCII fast path
+    {
+        *length = 1;
+        return asciiCharClass[s[0]];
+    }
+
+    unsigned int codePoint;
+    int sequenceLength = decodeUtf8(s, &codePoint);
+    if (sequenceLength == 0)
+    {
+        *length = 1; // Malformed UTF-8: consume one byte and reject it
+        return CHAR_UNKNOWN;
+    }
+
+    *length = sequenceLength;
+    if (isInRanges(codePoint, xidStartRanges, sizeof(xidStartRanges) / sizeof(xidStartRanges[0])))
         return CHAR_LETTER;
-    if (isdigit(c)) // Check if the character is a digit
-        return CHAR_DIGIT;
-    if (c == '+' || c == '-' || c == '*' || c == '/') // Check for arithmetic operators
-        return CHAR_OPERATOR;
-    if (c == '.') // Check for decimal point
-        return CHAR_DOT;
-    return CHAR_UNKNOWN; // Any other character is classified as unknown
+    if (isInRanges(codePoint, xidContinueRanges, sizeof(xidContinueRanges) / sizeof(xidContinueRanges[0])))
+        return CHAR_CONTINUE;
+    return CHAR_UNKNOWN;
 }
 
 // Function to recognise the type of token from the input string
 TokenType recogniseToken(const char *input)
 {
+    const unsigned char *bytes = (const unsigned char *)input; // Classify bytes, not signed chars
     int state = START; // Start at the initial state
     int i = 0;
+    int length;
 
-    // Process each character of the input string
-    while (input[i] != '\0')
+    // Process each character (one byte, or one UTF-8 sequence) of the input string
+    while (bytes[i] != '\0')
     {
-        char c = input[i];
-        int charClass = getCharClass(c); // Get character class
+        int charClass = getCharClass(bytes + i, &length); // Get character class
 
         // Transition to the next state based on current state and character class
         state = transitionTable[state][charClass];
-        i++;
+        i += length;
     }
 
     // Determine token type based on the final state after processing all characters
     if (state == IDENTIFIER && strncmp(input, "id", 2) == 0)
         return TOKEN_IDENTIFIER;       // If the string starts with "id", it's an identifier
 
-    // Recognise float: must end in FLOAT state and contain at least one digit before and after '.'
+    // Recognise float: the DFA only reaches FLOAT with at least one digit before and after '.'
     if (state == FLOAT)
-    {
-        // Check for at least one digit before and after '.'
-        const char *dot = strchr(input, '.');
-        if (dot != NULL && dot != input) // dot not at start
-        {
-            int before = dot - input;
-            int after = strlen(dot + 1);
-            if (before > 0 && after > 0)
-                return TOKEN_FLOAT;
-        }
-    }
+        return TOKEN_FLOAT;
+    if (state == EXPONENT)
+        return TOKEN_EXPONENT; // Integer or float followed by a complete exponent
+    if (state == HEX_INTEGER)
+        return TOKEN_HEX_INTEGER; // "0x" followed by at least one hex digit
 
-    if (state == UNSIGNED_INTEGER)
-        return TOKEN_UNSIGNED_INTEGER; // If final state is UNSIGNED_INTEGER, return that type
+    if (state == UNSIGNED_INTEGER || state == LEADING_ZERO)
+        return TOKEN_UNSIGNED_INTEGER; // If final state is UNSIGNED_INTEGER (or a lone '0'), return that type
     if (state == OPERATOR && strlen(input) == 1)
         return TOKEN_OPERATOR; // If it is a single operator, return operator type
     if (strcmp(input, "in") == 0)
@@ -165,6 +313,12 @@ void lexer(const char *input)
         case TOKEN_FLOAT:
             tokenName = "Floating Point";
             break;
+        case TOKEN_EXPONENT:
+            tokenName = "Exponent Number";
+            break;
+        case TOKEN_HEX_INTEGER:
+            tokenName = "Hexadecimal Integer";
+            break;
         case TOKEN_OPERATOR:
             tokenName = "Operator";
             break;
@@ -0,0 +1,142 @@
+/*
+ * Throughput Benchmark for lexer_float.c
+ * Purpose: This program measures how many tokens per second recogniseToken() from lexer_float.c
+ * classifies. The corpus is produced by a fixed pseudo-random generator (same seed every run),
+ * so every build of the lexer is timed on exactly the same tokens.
+ *
+ * Corpus:
+ * - Simple numbers: unsigned integers (e.g., 482913) and floats (e.g., 7321.045), the only
+ *   numeric forms the original lexer recognised. This is the corpus that must not regress.
+ * - Mixed ASCII: integers, floats and ASCII identifiers (e.g., idvar417), one third each.
+ * - UTF-8 identifiers: identifiers with non-ASCII letters and combining marks (e.g., idкод417,
+ *   idनमस्ते417). Older lexers report these as Unknown, so their checksum differs by design.
+ *
+ * How to Compile and Run:
+ * 1. Keep this file next to "lexer_float.c" and "unicode_xid_ranges.h" (it includes the lexer
+ *    source directly).
+ * 2. Compile the benchmark with optimisation enabled:
+ *      gcc -O2 lexer_float_bench.c -o lexer_float_bench
+ * 3. Run it:
+ *      ./lexer_float_bench
+ * 4. To compare against an older lexer, save that revision under another name and point
+ *    LEXER_SOURCE at it, for example:
+ *      git show <revision>:lexer_float.c > lexer_float_old.c
+ *      gcc -O2 -DLEXER_SOURCE='"lexer_float_old.c"' lexer_float_bench.c -o lexer_float_bench_old
+ *      ./lexer_float_bench_old
+ *
+ * Each corpus is timed several times and the best run is reported in millions of tokens per
+ * second (Mtok/s). The checksum is the sum of the returned token types. Newer token types are
+ * appended after TOKEN_UNKNOWN, so the original types keep their values and builds that classify
+ * the corpus the same way print the same checksum.
+ */
+
+#include <stdio.h>
+#include <time.h>
+
+#ifndef LEXER_SOURCE
+#define LEXER_SOURCE "lexer_float.c"
+#endif
+
+// Include the lexer with its main() renamed so this file can provide its own
+#define main lexer_float_main
+#include LEXER_SOURCE
+#undef main
+
+#define CORPUS_SIZE 200000  // Number of tokens in each corpus
+#define TOKEN_LENGTH 40     // Room for the longest generated token plus '\0'
+#define PASSES_PER_RUN 10   // Passes over the corpus in one timed run
+#define RUNS 15             // Timed runs; the fastest one is reported
+
+char corpus[CORPUS_SIZE][TOKEN_LENGTH];
+unsigned int seed;
+
+// Function returning the next pseudo-random number (linear congruential generator)
+unsigned int nextRandom(void)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 8) & 0xFFFFFF;
+}
+
+// Function to fill the corpus with unsigned integers and floats, alternating
+void buildSimpleNumberCorpus(void)
+{
+    seed = 1;
+    for (int i = 0; i < CORPUS_SIZE; i++)
+    {
+        if (i % 2 == 0)
+            snprintf(corpus[i], TOKEN_LENGTH, "%u", nextRandom() % 1000000);
+        else
+            snprintf(corpus[i], TOKEN_LENGTH, "%u.%03u", nextRandom() % 10000, nextRandom() % 1000);
+    }
+}
+
+// Function to fill the corpus with integers, floats and ASCII identifiers, one third each
+void buildMixedAsciiCorpus(void)
+{
+    seed = 2;
+    for (int i = 0; i < CORPUS_SIZE; i++)
+    {
+        if (i % 3 == 0)
+            snprintf(corpus[i], TOKEN_LENGTH, "%u", nextRandom() % 1000000);
+        else if (i % 3 == 1)
+            snprintf(corpus[i], TOKEN_LENGTH, "%u.%03u", nextRandom() % 10000, nextRandom() % 1000);
+        else
+            snprintf(corpus[i], TOKEN_LENGTH, "idvar%u", nextRandom() % 1000);
+    }
+}
+
+// Function to fill the corpus with identifiers that contain non-ASCII letters and marks
+void buildUtf8IdentifierCorpus(void)
+{
+    const char *stems[] = {"idкод", "idπ", "idコーヒー", "idनमस्ते", "idสวัสดี", "idپدر", "ide\xCC\x81"};
+    int stemCount = sizeof(stems) / sizeof(stems[0]);
+
+    seed = 3;
+    for (int i = 0; i < CORPUS_SIZE; i++)
+        snprintf(corpus[i], TOKEN_LENGTH, "%s%u", stems[nextRandom() % stemCount], nextRandom() % 1000);
+}
+
+// Function to time recogniseToken() over the corpus and print the best throughput
+void runBenchmark(const char *name)
+{
+    double bestSeconds = 0;
+    long checksum = 0;
+
+    for (int run = 0; run < RUNS; run++)
+    {
+        struct timespec begin, end;
+        long sum = 0;
+
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        for (int pass = 0; pass < PASSES_PER_RUN; pass++)
+        {
+            for (int i = 0; i < CORPUS_SIZE; i++)
+                sum += recogniseToken(corpus[i]);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        double seconds = (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) / 1e9;
+        if (run == 0 || seconds < bestSeconds)
+            bestSeconds = seconds;
+        checksum = sum / PASSES_PER_RUN;
+    }
+
+    double tokens = (double)CORPUS_SIZE * PASSES_PER_RUN;
+    printf("%-18s %8.1f Mtok/s  (checksum %ld)\n", name, tokens / bestSeconds / 1e6, checksum);
+}
+
+int main()
+{
+    printf("Lexer source: %s\n", LEXER_SOURCE);
+
+    buildSimpleNumberCorpus();
+    runBenchmark("simple numbers");
+
+    buildMixedAsciiCorpus();
+    runBenchmark("mixed ASCII");
+
+    buildUtf8IdentifierCorpus();
+    runBenchmark("UTF-8 identifiers");
+
+    return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * Check Program for lexer_float.c
+ * Purpose: This program runs recogniseToken() and getCharClass() from lexer_float.c on a fixed
+ * set of inputs and compares the results with the expected answers. It covers:
+ * - The ASCII table: reduced to the baseline's five classes, every ASCII byte must get the same
+ *   class as the baseline's ctype-based classifier (copied below as baselineCharClass).
+ * - UTF-8 decoding: valid 2-, 3- and 4-byte characters, overlong forms, surrogates, values above
+ *   U+10FFFF, sequences cut off at the end of the token and stray continuation bytes.
+ * - Identifiers in several scripts, including combining marks (XID_Start / XID_Continue).
+ * - Numeric literals: integers, floats, exponents, hex and digit separators.
+ *
+ * How to Compile and Run:
+ * 1. Keep this file next to "lexer_float.c" and "unicode_xid_ranges.h" (it includes the lexer
+ *    source directly).
+ * 2. Compile the check program using the command:
+ *      gcc lexer_float_check.c -o lexer_float_check
+ * 3. Run it:
+ *      ./lexer_float_check
+ * 4. Every failing case is printed; the program exits with status 1 if any case fails.
+ */
+
+#include <stdio.h>
+#include <ctype.h>
+
+// Include the lexer with its main() renamed so this file can provide its own
+#define main lexer_float_main
+#include "lexer_float.c"
+#undef main
+
+// One input token and the token type the lexer must return for it
+typedef struct
+{
+    const char *input;
+    TokenType expected;
+    const char *description;
+} TokenCase;
+
+// One input character and the class and byte length getCharClass() must return for it
+typedef struct
+{
+    const char *input;
+    int expectedClass;
+    int expectedLength;
+    const char *description;
+} CharCase;
+
+const TokenCase tokenCases[] = {
+    // Valid UTF-8 identifiers
+    {"id\xC3\xA9", TOKEN_IDENTIFIER, "2-byte letter U+00E9"},
+    {"id\xE6\x97\xA5", TOKEN_IDENTIFIER, "3-byte letter U+65E5"},
+    {"id\xF0\xA0\x80\x80", TOKEN_IDENTIFIER, "4-byte letter U+20000"},
+    {"idπ", TOKEN_IDENTIFIER, "Greek"},
+    {"idкод", TOKEN_IDENTIFIER, "Cyrillic"},
+    {"idコーヒー", TOKEN_IDENTIFIER, "Katakana with long-vowel mark U+30FC"},
+    {"idनमस्ते", TOKEN_IDENTIFIER, "Devanagari with vowel signs and virama"},
+    {"idสวัสดี", TOKEN_IDENTIFIER, "Thai letters and marks"},
+    {"idپدر", TOKEN_IDENTIFIER, "Persian letter U+067E"},
+    {"idی", TOKEN_IDENTIFIER, "Persian/Urdu letter U+06CC"},
+    {"ide\xCC\x81", TOKEN_IDENTIFIER, "decomposed e + combining acute U+0301"},
+    {"idx١", TOKEN_IDENTIFIER, "Arabic-Indic digit after a letter"},
+    {"id1", TOKEN_IDENTIFIER, "ASCII digit right after id"},
+    {"id١", TOKEN_IDENTIFIER, "non-ASCII digit right after id"},
+    {"id\xCC\x81", TOKEN_IDENTIFIER, "combining mark right after id"},
+
+    // Valid UTF-8 that is not allowed where it appears
+    {"id×", TOKEN_UNKNOWN, "multiplication sign U+00D7"},
+    {"id\xF0\x9F\x98\x80", TOKEN_UNKNOWN, "emoji U+1F600"},
+    {"π", TOKEN_UNKNOWN, "letter without the id prefix"},
+    {"idx_y", TOKEN_UNKNOWN, "ASCII connector '_' inside an identifier"},
+    {"idx‿y", TOKEN_UNKNOWN, "connector punctuation U+203F inside an identifier"},
+    {"idx＿y", TOKEN_UNKNOWN, "fullwidth low line U+FF3F inside an identifier"},
+
+    // Malformed UTF-8
+    {"id\xC0\xAF", TOKEN_UNKNOWN, "overlong 2-byte C0 AF"},
+    {"id\xC1\xBF", TOKEN_UNKNOWN, "overlong 2-byte C1 BF"},
+    {"id\xE0\x80\xAF", TOKEN_UNKNOWN, "overlong 3-byte E0 80 AF"},
+    {"id\xF0\x80\x80\xAF", TOKEN_UNKNOWN, "overlong 4-byte F0 80 80 AF"},
+    {"id\xE0\x83\xA9", TOKEN_UNKNOWN, "overlong 3-byte form of the letter U+00E9"},
+    {"id\xED\xA0\x80", TOKEN_UNKNOWN, "surrogate ED A0 80"},
+    {"id\xED\xBF\xBF", TOKEN_UNKNOWN, "surrogate ED BF BF"},
+    {"id\xF4\x90\x80\x80", TOKEN_UNKNOWN, "above U+10FFFF F4 90 80 80"},
+    {"id\xF5\x80\x80\x80", TOKEN_UNKNOWN, "invalid lead byte F5"},
+    {"id\xE2\x82", TOKEN_UNKNOWN, "truncated 3-byte E2 82 at end of token"},
+    {"id\xC3", TOKEN_UNKNOWN, "truncated 2-byte C3 at end of token"},
+    {"id\xF0\x9F\x98", TOKEN_UNKNOWN, "truncated 4-byte F0 9F 98 at end of token"},
+    {"id\x80", TOKEN_UNKNOWN, "stray continuation byte 80"},
+    {"id\xBF" "a", TOKEN_UNKNOWN, "stray continuation byte BF before a letter"},
+    {"id\xC3" "a", TOKEN_UNKNOWN, "lead byte C3 followed by ASCII"},
+
+    // Numeric literals
+    {"42", TOKEN_UNSIGNED_INTEGER, "integer"},
+    {"0", TOKEN_UNSIGNED_INTEGER, "lone zero"},
+    {"01", TOKEN_UNSIGNED_INTEGER, "leading zero"},
+    {"1_000_000", TOKEN_UNSIGNED_INTEGER, "integer with separators"},
+    {"3.14", TOKEN_FLOAT, "float"},
+    {"2.5_5", TOKEN_FLOAT, "float with separator"},
+    {"1e-9", TOKEN_EXPONENT, "integer with signed exponent"},
+    {"6.02E23", TOKEN_EXPONENT, "float with exponent"},
+    {"0x1F", TOKEN_HEX_INTEGER, "hex"},
+    {"0xAB_cd", TOKEN_HEX_INTEGER, "hex with separator"},
+    {"1__0", TOKEN_UNKNOWN, "double separator"},
+    {"1_", TOKEN_UNKNOWN, "trailing separator"},
+    {"_1", TOKEN_UNKNOWN, "leading separator"},
+    {"0x", TOKEN_UNKNOWN, "hex prefix without digits"},
+    {"0x_1", TOKEN_UNKNOWN, "separator right after hex prefix"},
+    {"1e", TOKEN_UNKNOWN, "exponent without digits"},
+    {"1e+", TOKEN_UNKNOWN, "exponent sign without digits"},
+    {"1.", TOKEN_UNKNOWN, "float without fraction"},
+    {".5", TOKEN_UNKNOWN, "float without integer part"},
+
+    // Keywords and operators
+    {"in", TOKEN_KEYWORD_IN, "keyword in"},
+    {"out", TOKEN_KEYWORD_OUT, "keyword out"},
+    {"-", TOKEN_OPERATOR, "operator -"},
+    {"*", TOKEN_OPERATOR, "operator *"},
+    {"abc", TOKEN_UNKNOWN, "identifier without the id prefix"}
+};
+
+const CharCase charCases[] = {
+    {"\xC3\xA9", CHAR_LETTER, 2, "2-byte letter U+00E9"},
+    {"\xE3\x83\xBC", CHAR_LETTER, 3, "3-byte letter U+30FC"},
+    {"\xF0\xA0\x80\x80", CHAR_LETTER, 4, "4-byte letter U+20000"},
+    {"\xCC\x81", CHAR_CONTINUE, 2, "combining mark U+0301"},
+    {"\xE0\xA5\x8D", CHAR_CONTINUE, 3, "Devanagari virama U+094D"},
+    {"\xF0\x9F\x98\x80", CHAR_UNKNOWN, 4, "valid emoji U+1F600"},
+    {"\xE2\x80\xBF", CHAR_UNKNOWN, 3, "connector punctuation U+203F"},
+    {"\xC0\xAF", CHAR_UNKNOWN, 1, "overlong C0 AF"},
+    {"\xE0\x80\xAF", CHAR_UNKNOWN, 1, "overlong E0 80 AF"},
+    {"\xF0\x80\x80\xAF", CHAR_UNKNOWN, 1, "overlong F0 80 80 AF"},
+    {"\xED\xA0\x80", CHAR_UNKNOWN, 1, "surrogate ED A0 80"},
+    {"\xF4\x90\x80\x80", CHAR_UNKNOWN, 1, "above U+10FFFF F4 90 80 80"},
+    {"\xE2\x82", CHAR_UNKNOWN, 1, "truncated E2 82"},
+    {"\x80", CHAR_UNKNOWN, 1, "stray continuation byte 80"}
+};
+
+// Character classes of the baseline lexer, before the numeric and UTF-8 extensions
+enum
+{
+    BASE_LETTER,   // Alphabetic characters
+    BASE_DIGIT,    // Digits (0-9)
+    BASE_OPERATOR, // Arithmetic operators (+, -, *, /)
+    BASE_DOT,      // Decimal point '.'
+    BASE_UNKNOWN   // Any other character
+};
+
+// The baseline getCharClass(), unchanged apart from its name and return values
+// The lexer never calls setlocale(), so isalpha/isdigit use the "C" locale for ASCII
+int baselineCharClass(char c)
+{
+    if (isalpha(c)) // Check if the character is an alphabet
+        return BASE_LETTER;
+    if (isdigit(c)) // Check if the character is a digit
+        return BASE_DIGIT;
+    if (c == '+' || c == '-' || c == '*' || c == '/') // Check for arithmetic operators
+        return BASE_OPERATOR;
+    if (c == '.') // Check for decimal point
+        return BASE_DOT;
+    return BASE_UNKNOWN; // Any other character is classified as unknown
+}
+
+// Function to map a class of the current lexer to the baseline class it was split from
+// ('_' was an unknown character in the baseline)
+int toBaselineClass(int charClass)
+{
+    switch (charClass)
+    {
+    case CHAR_LETTER:
+    case CHAR_HEX_LETTER:
+    case CHAR_EXPONENT:
+    case CHAR_HEX_MARK:
+        return BASE_LETTER;
+    case CHAR_ZERO:
+    case CHAR_DIGIT:
+        return BASE_DIGIT;
+    case CHAR_SIGN:
+    case CHAR_OPERATOR:
+        return BASE_OPERATOR;
+    case CHAR_DOT:
+        return BASE_DOT;
+    default:
+        return BASE_UNKNOWN;
+    }
+}
+
+int main()
+{
+    int failures = 0;
+    int checks = 0;
+
+    // Every ASCII byte must keep the baseline class it had before the classes were split
+    for (int c = 1; c < 128; c++)
+    {
+        unsigned char bytes[2] = {(unsigned char)c, '\0'};
+        int length;
+        int baseClass = toBaselineClass(getCharClass(bytes, &length));
+        checks++;
+        if (baseClass != baselineCharClass((char)c) || length != 1)
+        {
+            printf("FAIL ASCII 0x%02X: baseline class %d length %d, expected baseline class %d length 1\n",
+                   c, baseClass, length, baselineCharClass((char)c));
+            failures++;
+        }
+    }
+
+    // Single characters: class and number of bytes consumed
+    for (size_t i = 0; i < sizeof(charCases) / sizeof(charCases[0]); i++)
+    {
+        int length;
+        int charClass = getCharClass((const unsigned char *)charCases[i].input, &length);
+        checks++;
+        if (charClass != charCases[i].expectedClass || length != charCases[i].expectedLength)
+        {
+            printf("FAIL char %s: class %d length %d, expected class %d length %d\n",
+                   charCases[i].description, charClass, length,
+                   charCases[i].expectedClass, charCases[i].expectedLength);
+            failures++;
+        }
+    }
+
+    // Whole tokens
+    for (size_t i = 0; i < sizeof(tokenCases) / sizeof(tokenCases[0]); i++)
+    {
+        TokenType type = recogniseToken(tokenCases[i].input);
+        checks++;
+        if (type != tokenCases[i].expected)
+        {
+            printf("FAIL token %s: got %d, expected %d\n",
+                   tokenCases[i].description, type, tokenCases[i].expected);
+            failures++;
+        }
+    }
+
+    printf("%d of %d checks passed\n", checks - failures, checks);
+    return failures == 0 ? 0 : 1;
+}